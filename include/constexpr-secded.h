@@ -26,6 +26,7 @@
 #define CONSTEXPR_SECDED_H
 
 #ifdef __cplusplus
+# include <cstddef>
 # include <cstdint>
 # include <type_traits>
 #else
@@ -44,6 +45,13 @@
  */
 #define SECDED_8_4_ENCODE(v) ((uint8_t)(((uint8_t)(v)) | (((((v) & ((((uint8_t)(1))) << (((uint8_t)(0))))) >> (((uint8_t)(0)))) ^ (((v) & ((((uint8_t)(1))) << (((uint8_t)(2))))) >> (((uint8_t)(2)))) ^ (((v) & ((((uint8_t)(1))) << (((uint8_t)(3))))) >> (((uint8_t)(3))))) << (((uint8_t)(4)))) | (((((v) & ((((uint8_t)(1))) << (((uint8_t)(0))))) >> (((uint8_t)(0)))) ^ (((v) & ((((uint8_t)(1))) << (((uint8_t)(1))))) >> (((uint8_t)(1)))) ^ (((v) & ((((uint8_t)(1))) << (((uint8_t)(3))))) >> (((uint8_t)(3))))) << (((uint8_t)(5)))) | (((((v) & ((((uint8_t)(1))) << (((uint8_t)(0))))) >> (((uint8_t)(0)))) ^ (((v) & ((((uint8_t)(1))) << (((uint8_t)(1))))) >> (((uint8_t)(1)))) ^ (((v) & ((((uint8_t)(1))) << (((uint8_t)(2))))) >> (((uint8_t)(2))))) << (((uint8_t)(6)))) | (((((v) & ((((uint8_t)(1))) << (((uint8_t)(1))))) >> (((uint8_t)(1)))) ^ (((v) & ((((uint8_t)(1))) << (((uint8_t)(2))))) >> (((uint8_t)(2)))) ^ (((v) & ((((uint8_t)(1))) << (((uint8_t)(3))))) >> (((uint8_t)(3))))) << (((uint8_t)(7))))))
 
+/*
+ * Updates the codeword c after the lower 4 bits of the encoded data changed
+ * from old_v to new_v. Only the changed bits need to be known, so old_v and
+ * new_v may also be a single field of the data, shifted into place.
+ */
+#define SECDED_8_4_UPDATE(c, old_v, new_v) ((uint8_t)(((uint8_t)(c)) ^ SECDED_8_4_ENCODE((((old_v) ^ (new_v)) & ((((uint8_t)(1)) << (((uint8_t)(4)))) - ((uint8_t)(1)))))))
+
 /*
  * Encodes the lower 4 bits into a 8 bit unsigned integer.
  * The results are guaranteed to have a hamming distance of at least 4.
@@ -176,6 +184,25 @@ template<> constexpr std::int64_t secded_encode_4_bits<std::int64_t>(std::int8_t
   return SECDED_4_BITS_TO_SIGNED_64(v);
 }
 
+/*
+ * Updates the value c, which was returned by secded_encode_4_bits<T>, after
+ * the lower 4 bits of the encoded data changed from old_v to new_v.
+ */
+template <typename T>
+constexpr typename std::enable_if<std::is_unsigned<T>::value, T>::type secded_update_4_bits(T c, std::uint8_t old_v, std::uint8_t new_v) {
+  return static_cast<T>(c ^ secded_encode_4_bits<T>(static_cast<std::uint8_t>((old_v ^ new_v) & 0xf)));
+}
+
+/*
+ * Updates the value c, which was returned by secded_encode_4_bits<T>, after
+ * the lower 4 bits of the encoded data changed from old_v to new_v.
+ * Wider signed types are not supported because their encoding is not linear.
+ */
+template <typename T>
+constexpr typename std::enable_if<std::is_same<T, std::int8_t>::value, T>::type secded_update_4_bits(T c, std::int8_t old_v, std::int8_t new_v) {
+  return static_cast<T>(c ^ secded_encode_4_bits<T>(static_cast<std::int8_t>((old_v ^ new_v) & 0xf)));
+}
+
 #endif  /* __cplusplus */
 
 /*
@@ -191,6 +218,13 @@ template<> constexpr std::int64_t secded_encode_4_bits<std::int64_t>(std::int8_t
  */
 #define SECDED_16_11_ENCODE(v) ((uint16_t)(((uint16_t)(v)) | (((((v) & ((((uint16_t)(1))) << (((uint16_t)(0))))) >> (((uint16_t)(0)))) ^ (((v) & ((((uint16_t)(1))) << (((uint16_t)(1))))) >> (((uint16_t)(1)))) ^ (((v) & ((((uint16_t)(1))) << (((uint16_t)(3))))) >> (((uint16_t)(3)))) ^ (((v) & ((((uint16_t)(1))) << (((uint16_t)(4))))) >> (((uint16_t)(4)))) ^ (((v) & ((((uint16_t)(1))) << (((uint16_t)(5))))) >> (((uint16_t)(5)))) ^ (((v) & ((((uint16_t)(1))) << (((uint16_t)(7))))) >> (((uint16_t)(7)))) ^ (((v) & ((((uint16_t)(1))) << (((uint16_t)(9))))) >> (((uint16_t)(9))))) << (((uint16_t)(11)))) | (((((v) & ((((uint16_t)(1))) << (((uint16_t)(0))))) >> (((uint16_t)(0)))) ^ (((v) & ((((uint16_t)(1))) << (((uint16_t)(1))))) >> (((uint16_t)(1)))) ^ (((v) & ((((uint16_t)(1))) << (((uint16_t)(3))))) >> (((uint16_t)(3)))) ^ (((v) & ((((uint16_t)(1))) << (((uint16_t)(6))))) >> (((uint16_t)(6)))) ^ (((v) & ((((uint16_t)(1))) << (((uint16_t)(7))))) >> (((uint16_t)(7)))) ^ (((v) & ((((uint16_t)(1))) << (((uint16_t)(8))))) >> (((uint16_t)(8)))) ^ (((v) & ((((uint16_t)(1))) << (((uint16_t)(10))))) >> (((uint16_t)(10))))) << (((uint16_t)(12)))) | (((((v) & ((((uint16_t)(1))) << (((uint16_t)(0))))) >> (((uint16_t)(0)))) ^ (((v) & ((((uint16_t)(1))) << (((uint16_t)(2))))) >> (((uint16_t)(2)))) ^ (((v) & ((((uint16_t)(1))) << (((uint16_t)(4))))) >> (((uint16_t)(4)))) ^ (((v) & ((((uint16_t)(1))) << (((uint16_t)(5))))) >> (((uint16_t)(5)))) ^ (((v) & ((((uint16_t)(1))) << (((uint16_t)(6))))) >> (((uint16_t)(6)))) ^ (((v) & ((((uint16_t)(1))) << (((uint16_t)(7))))) >> (((uint16_t)(7)))) ^ (((v) & ((((uint16_t)(1))) << (((uint16_t)(8))))) >> (((uint16_t)(8))))) << (((uint16_t)(13)))) | (((((v) & ((((uint16_t)(1))) << (((uint16_t)(0))))) >> (((uint16_t)(0)))) ^ (((v) & ((((uint16_t)(1))) << (((uint16_t)(1))))) >> (((uint16_t)(1)))) ^ (((v) & ((((uint16_t)(1))) << (((uint16_t)(2))))) >> (((uint16_t)(2)))) ^ (((v) & ((((uint16_t)(1))) << (((uint16_t)(4))))) >> (((uint16_t)(4)))) ^ (((v) & ((((uint16_t)(1))) << (((uint16_t)(8))))) >> (((uint16_t)(8)))) ^ (((v) & ((((uint16_t)(1))) << (((uint16_t)(9))))) >> (((uint16_t)(9)))) ^ (((v) & ((((uint16_t)(1))) << (((uint16_t)(10))))) >> (((uint16_t)(10))))) << (((uint16_t)(14)))) | (((((v) & ((((uint16_t)(1))) << (((uint16_t)(0))))) >> (((uint16_t)(0)))) ^ (((v) & ((((uint16_t)(1))) << (((uint16_t)(2))))) >> (((uint16_t)(2)))) ^ (((v) & ((((uint16_t)(1))) << (((uint16_t)(3))))) >> (((uint16_t)(3)))) ^ (((v) & ((((uint16_t)(1))) << (((uint16_t)(5))))) >> (((uint16_t)(5)))) ^ (((v) & ((((uint16_t)(1))) << (((uint16_t)(6))))) >> (((uint16_t)(6)))) ^ (((v) & ((((uint16_t)(1))) << (((uint16_t)(9))))) >> (((uint16_t)(9)))) ^ (((v) & ((((uint16_t)(1))) << (((uint16_t)(10))))) >> (((uint16_t)(10))))) << (((uint16_t)(15))))))
 
+/*
+ * Updates the codeword c after the lower 11 bits of the encoded data changed
+ * from old_v to new_v. Only the changed bits need to be known, so old_v and
+ * new_v may also be a single field of the data, shifted into place.
+ */
+#define SECDED_16_11_UPDATE(c, old_v, new_v) ((uint16_t)(((uint16_t)(c)) ^ SECDED_16_11_ENCODE((((old_v) ^ (new_v)) & ((((uint16_t)(1)) << (((uint16_t)(11)))) - ((uint16_t)(1)))))))
+
 /*
  * Encodes the lower 11 bits into a 16 bit unsigned integer.
  * The results are guaranteed to have a hamming distance of at least 4.
@@ -291,6 +325,25 @@ template<> constexpr std::int64_t secded_encode_11_bits<std::int64_t>(std::int16
   return SECDED_11_BITS_TO_SIGNED_64(v);
 }
 
+/*
+ * Updates the value c, which was returned by secded_encode_11_bits<T>, after
+ * the lower 11 bits of the encoded data changed from old_v to new_v.
+ */
+template <typename T>
+constexpr typename std::enable_if<std::is_unsigned<T>::value, T>::type secded_update_11_bits(T c, std::uint16_t old_v, std::uint16_t new_v) {
+  return static_cast<T>(c ^ secded_encode_11_bits<T>(static_cast<std::uint16_t>((old_v ^ new_v) & 0x7ff)));
+}
+
+/*
+ * Updates the value c, which was returned by secded_encode_11_bits<T>, after
+ * the lower 11 bits of the encoded data changed from old_v to new_v.
+ * Wider signed types are not supported because their encoding is not linear.
+ */
+template <typename T>
+constexpr typename std::enable_if<std::is_same<T, std::int16_t>::value, T>::type secded_update_11_bits(T c, std::int16_t old_v, std::int16_t new_v) {
+  return static_cast<T>(c ^ secded_encode_11_bits<T>(static_cast<std::int16_t>((old_v ^ new_v) & 0x7ff)));
+}
+
 #endif  /* __cplusplus */
 
 /*
@@ -307,6 +360,13 @@ template<> constexpr std::int64_t secded_encode_11_bits<std::int64_t>(std::int16
  */
 #define SECDED_32_26_ENCODE(v) ((uint32_t)(((uint32_t)(v)) | (((((v) & ((((uint32_t)(1))) << (((uint32_t)(0))))) >> (((uint32_t)(0)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(2))))) >> (((uint32_t)(2)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(3))))) >> (((uint32_t)(3)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(5))))) >> (((uint32_t)(5)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(7))))) >> (((uint32_t)(7)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(8))))) >> (((uint32_t)(8)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(9))))) >> (((uint32_t)(9)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(11))))) >> (((uint32_t)(11)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(13))))) >> (((uint32_t)(13)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(15))))) >> (((uint32_t)(15)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(17))))) >> (((uint32_t)(17)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(19))))) >> (((uint32_t)(19)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(21))))) >> (((uint32_t)(21)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(23))))) >> (((uint32_t)(23)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(25))))) >> (((uint32_t)(25))))) << (((uint32_t)(26)))) | (((((v) & ((((uint32_t)(1))) << (((uint32_t)(0))))) >> (((uint32_t)(0)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(1))))) >> (((uint32_t)(1)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(2))))) >> (((uint32_t)(2)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(3))))) >> (((uint32_t)(3)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(6))))) >> (((uint32_t)(6)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(7))))) >> (((uint32_t)(7)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(10))))) >> (((uint32_t)(10)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(11))))) >> (((uint32_t)(11)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(14))))) >> (((uint32_t)(14)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(15))))) >> (((uint32_t)(15)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(16))))) >> (((uint32_t)(16)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(18))))) >> (((uint32_t)(18)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(19))))) >> (((uint32_t)(19)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(22))))) >> (((uint32_t)(22)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(23))))) >> (((uint32_t)(23))))) << (((uint32_t)(27)))) | (((((v) & ((((uint32_t)(1))) << (((uint32_t)(0))))) >> (((uint32_t)(0)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(4))))) >> (((uint32_t)(4)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(5))))) >> (((uint32_t)(5)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(6))))) >> (((uint32_t)(6)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(7))))) >> (((uint32_t)(7)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(8))))) >> (((uint32_t)(8)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(12))))) >> (((uint32_t)(12)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(13))))) >> (((uint32_t)(13)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(14))))) >> (((uint32_t)(14)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(15))))) >> (((uint32_t)(15)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(16))))) >> (((uint32_t)(16)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(20))))) >> (((uint32_t)(20)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(21))))) >> (((uint32_t)(21)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(22))))) >> (((uint32_t)(22)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(23))))) >> (((uint32_t)(23))))) << (((uint32_t)(28)))) | (((((v) & ((((uint32_t)(1))) << (((uint32_t)(0))))) >> (((uint32_t)(0)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(1))))) >> (((uint32_t)(1)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(2))))) >> (((uint32_t)(2)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(4))))) >> (((uint32_t)(4)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(8))))) >> (((uint32_t)(8)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(9))))) >> (((uint32_t)(9)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(10))))) >> (((uint32_t)(10)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(11))))) >> (((uint32_t)(11)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(12))))) >> (((uint32_t)(12)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(13))))) >> (((uint32_t)(13)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(14))))) >> (((uint32_t)(14)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(15))))) >> (((uint32_t)(15)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(16))))) >> (((uint32_t)(16)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(24))))) >> (((uint32_t)(24)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(25))))) >> (((uint32_t)(25))))) << (((uint32_t)(29)))) | (((((v) & ((((uint32_t)(1))) << (((uint32_t)(0))))) >> (((uint32_t)(0)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(1))))) >> (((uint32_t)(1)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(2))))) >> (((uint32_t)(2)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(4))))) >> (((uint32_t)(4)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(8))))) >> (((uint32_t)(8)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(16))))) >> (((uint32_t)(16)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(17))))) >> (((uint32_t)(17)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(18))))) >> (((uint32_t)(18)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(19))))) >> (((uint32_t)(19)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(20))))) >> (((uint32_t)(20)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(21))))) >> (((uint32_t)(21)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(22))))) >> (((uint32_t)(22)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(23))))) >> (((uint32_t)(23)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(24))))) >> (((uint32_t)(24)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(25))))) >> (((uint32_t)(25))))) << (((uint32_t)(30)))) | (((((v) & ((((uint32_t)(1))) << (((uint32_t)(2))))) >> (((uint32_t)(2)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(3))))) >> (((uint32_t)(3)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(5))))) >> (((uint32_t)(5)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(6))))) >> (((uint32_t)(6)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(8))))) >> (((uint32_t)(8)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(9))))) >> (((uint32_t)(9)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(10))))) >> (((uint32_t)(10)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(12))))) >> (((uint32_t)(12)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(15))))) >> (((uint32_t)(15)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(16))))) >> (((uint32_t)(16)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(17))))) >> (((uint32_t)(17)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(18))))) >> (((uint32_t)(18)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(20))))) >> (((uint32_t)(20)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(23))))) >> (((uint32_t)(23)))) ^ (((v) & ((((uint32_t)(1))) << (((uint32_t)(24))))) >> (((uint32_t)(24))))) << (((uint32_t)(31))))))
 
+/*
+ * Updates the codeword c after the lower 26 bits of the encoded data changed
+ * from old_v to new_v. Only the changed bits need to be known, so old_v and
+ * new_v may also be a single field of the data, shifted into place.
+ */
+#define SECDED_32_26_UPDATE(c, old_v, new_v) ((uint32_t)(((uint32_t)(c)) ^ SECDED_32_26_ENCODE((((old_v) ^ (new_v)) & ((((uint32_t)(1)) << (((uint32_t)(26)))) - ((uint32_t)(1)))))))
+
 /*
  * Encodes the lower 26 bits into a 32 bit unsigned integer.
  * The results are guaranteed to have a hamming distance of at least 4.
@@ -375,6 +435,56 @@ template<> constexpr std::int64_t secded_encode_26_bits<std::int64_t>(std::int32
   return SECDED_26_BITS_TO_SIGNED_64(v);
 }
 
+/*
+ * Updates the value c, which was returned by secded_encode_26_bits<T>, after
+ * the lower 26 bits of the encoded data changed from old_v to new_v.
+ */
+template <typename T>
+constexpr typename std::enable_if<std::is_unsigned<T>::value, T>::type secded_update_26_bits(T c, std::uint32_t old_v, std::uint32_t new_v) {
+  return static_cast<T>(c ^ secded_encode_26_bits<T>(static_cast<std::uint32_t>((old_v ^ new_v) & 0x3ffffff)));
+}
+
+/*
+ * Updates the value c, which was returned by secded_encode_26_bits<T>, after
+ * the lower 26 bits of the encoded data changed from old_v to new_v.
+ * Wider signed types are not supported because their encoding is not linear.
+ */
+template <typename T>
+constexpr typename std::enable_if<std::is_same<T, std::int32_t>::value, T>::type secded_update_26_bits(T c, std::int32_t old_v, std::int32_t new_v) {
+  return static_cast<T>(c ^ secded_encode_26_bits<T>(static_cast<std::int32_t>((old_v ^ new_v) & 0x3ffffff)));
+}
+
+/*
+ * Updates the codewords in words, which were returned by
+ * secded_encode_26_bits<std::uint32_t> and together protect a block of
+ * data, after the n bytes starting at byte offset of the block changed from
+ * old_bytes to new_bytes. Bit j of byte i of the block is stored as bit
+ * (8 * i + j) % 26 of words[(8 * i + j) / 26]. Each word that overlaps
+ * the changed bytes is updated once, all other words are not accessed.
+ */
+inline void secded_update_26_bits_range(std::uint32_t* words, std::size_t offset, const std::uint8_t* old_bytes, const std::uint8_t* new_bytes, std::size_t n) {
+  std::size_t bit = 8 * offset;
+  std::size_t word = bit / 26;
+  std::uint32_t delta = 0;
+  for (std::size_t i = 0; i < n; i++, bit += 8) {
+    const std::uint32_t d = static_cast<std::uint8_t>(old_bytes[i] ^ new_bytes[i]);
+    if (d == 0) continue;
+    const std::size_t shift = bit % 26;
+    if (bit / 26 != word) {
+      if (delta != 0) words[word] = secded_update_26_bits<std::uint32_t>(words[word], 0, delta);
+      word = bit / 26;
+      delta = 0;
+    }
+    delta ^= d << shift;
+    if (shift > 26 - 8) {
+      words[word] = secded_update_26_bits<std::uint32_t>(words[word], 0, delta);
+      word++;
+      delta = d >> (26 - shift);
+    }
+  }
+  if (delta != 0) words[word] = secded_update_26_bits<std::uint32_t>(words[word], 0, delta);
+}
+
 #endif  /* __cplusplus */
 
 /*
@@ -392,6 +502,13 @@ template<> constexpr std::int64_t secded_encode_26_bits<std::int64_t>(std::int32
  */
 #define SECDED_64_57_ENCODE(v) ((uint64_t)(((uint64_t)(v)) | (((((v) & ((((uint64_t)(1))) << (((uint64_t)(0))))) >> (((uint64_t)(0)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(1))))) >> (((uint64_t)(1)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(3))))) >> (((uint64_t)(3)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(4))))) >> (((uint64_t)(4)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(5))))) >> (((uint64_t)(5)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(7))))) >> (((uint64_t)(7)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(9))))) >> (((uint64_t)(9)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(11))))) >> (((uint64_t)(11)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(13))))) >> (((uint64_t)(13)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(15))))) >> (((uint64_t)(15)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(16))))) >> (((uint64_t)(16)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(17))))) >> (((uint64_t)(17)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(19))))) >> (((uint64_t)(19)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(21))))) >> (((uint64_t)(21)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(23))))) >> (((uint64_t)(23)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(25))))) >> (((uint64_t)(25)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(27))))) >> (((uint64_t)(27)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(29))))) >> (((uint64_t)(29)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(31))))) >> (((uint64_t)(31)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(33))))) >> (((uint64_t)(33)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(35))))) >> (((uint64_t)(35)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(37))))) >> (((uint64_t)(37)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(39))))) >> (((uint64_t)(39)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(41))))) >> (((uint64_t)(41)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(43))))) >> (((uint64_t)(43)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(45))))) >> (((uint64_t)(45)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(47))))) >> (((uint64_t)(47)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(49))))) >> (((uint64_t)(49)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(51))))) >> (((uint64_t)(51)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(53))))) >> (((uint64_t)(53)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(55))))) >> (((uint64_t)(55))))) << (((uint64_t)(57)))) | (((((v) & ((((uint64_t)(1))) << (((uint64_t)(0))))) >> (((uint64_t)(0)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(2))))) >> (((uint64_t)(2)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(3))))) >> (((uint64_t)(3)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(4))))) >> (((uint64_t)(4)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(6))))) >> (((uint64_t)(6)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(7))))) >> (((uint64_t)(7)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(10))))) >> (((uint64_t)(10)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(11))))) >> (((uint64_t)(11)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(14))))) >> (((uint64_t)(14)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(15))))) >> (((uint64_t)(15)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(18))))) >> (((uint64_t)(18)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(19))))) >> (((uint64_t)(19)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(22))))) >> (((uint64_t)(22)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(23))))) >> (((uint64_t)(23)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(26))))) >> (((uint64_t)(26)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(27))))) >> (((uint64_t)(27)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(30))))) >> (((uint64_t)(30)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(31))))) >> (((uint64_t)(31)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(32))))) >> (((uint64_t)(32)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(34))))) >> (((uint64_t)(34)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(35))))) >> (((uint64_t)(35)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(38))))) >> (((uint64_t)(38)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(39))))) >> (((uint64_t)(39)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(42))))) >> (((uint64_t)(42)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(43))))) >> (((uint64_t)(43)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(46))))) >> (((uint64_t)(46)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(47))))) >> (((uint64_t)(47)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(50))))) >> (((uint64_t)(50)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(51))))) >> (((uint64_t)(51)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(54))))) >> (((uint64_t)(54)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(55))))) >> (((uint64_t)(55))))) << (((uint64_t)(58)))) | (((((v) & ((((uint64_t)(1))) << (((uint64_t)(0))))) >> (((uint64_t)(0)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(5))))) >> (((uint64_t)(5)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(6))))) >> (((uint64_t)(6)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(7))))) >> (((uint64_t)(7)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(8))))) >> (((uint64_t)(8)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(12))))) >> (((uint64_t)(12)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(13))))) >> (((uint64_t)(13)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(14))))) >> (((uint64_t)(14)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(15))))) >> (((uint64_t)(15)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(16))))) >> (((uint64_t)(16)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(20))))) >> (((uint64_t)(20)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(21))))) >> (((uint64_t)(21)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(22))))) >> (((uint64_t)(22)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(23))))) >> (((uint64_t)(23)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(28))))) >> (((uint64_t)(28)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(29))))) >> (((uint64_t)(29)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(30))))) >> (((uint64_t)(30)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(31))))) >> (((uint64_t)(31)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(32))))) >> (((uint64_t)(32)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(36))))) >> (((uint64_t)(36)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(37))))) >> (((uint64_t)(37)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(38))))) >> (((uint64_t)(38)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(39))))) >> (((uint64_t)(39)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(44))))) >> (((uint64_t)(44)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(45))))) >> (((uint64_t)(45)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(46))))) >> (((uint64_t)(46)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(47))))) >> (((uint64_t)(47)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(52))))) >> (((uint64_t)(52)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(53))))) >> (((uint64_t)(53)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(54))))) >> (((uint64_t)(54)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(55))))) >> (((uint64_t)(55))))) << (((uint64_t)(59)))) | (((((v) & ((((uint64_t)(1))) << (((uint64_t)(0))))) >> (((uint64_t)(0)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(1))))) >> (((uint64_t)(1)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(2))))) >> (((uint64_t)(2)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(4))))) >> (((uint64_t)(4)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(8))))) >> (((uint64_t)(8)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(9))))) >> (((uint64_t)(9)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(10))))) >> (((uint64_t)(10)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(11))))) >> (((uint64_t)(11)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(12))))) >> (((uint64_t)(12)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(13))))) >> (((uint64_t)(13)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(14))))) >> (((uint64_t)(14)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(15))))) >> (((uint64_t)(15)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(16))))) >> (((uint64_t)(16)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(24))))) >> (((uint64_t)(24)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(25))))) >> (((uint64_t)(25)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(26))))) >> (((uint64_t)(26)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(27))))) >> (((uint64_t)(27)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(28))))) >> (((uint64_t)(28)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(29))))) >> (((uint64_t)(29)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(30))))) >> (((uint64_t)(30)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(31))))) >> (((uint64_t)(31)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(32))))) >> (((uint64_t)(32)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(40))))) >> (((uint64_t)(40)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(41))))) >> (((uint64_t)(41)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(42))))) >> (((uint64_t)(42)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(43))))) >> (((uint64_t)(43)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(44))))) >> (((uint64_t)(44)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(45))))) >> (((uint64_t)(45)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(46))))) >> (((uint64_t)(46)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(47))))) >> (((uint64_t)(47)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(56))))) >> (((uint64_t)(56))))) << (((uint64_t)(60)))) | (((((v) & ((((uint64_t)(1))) << (((uint64_t)(0))))) >> (((uint64_t)(0)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(1))))) >> (((uint64_t)(1)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(2))))) >> (((uint64_t)(2)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(4))))) >> (((uint64_t)(4)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(8))))) >> (((uint64_t)(8)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(16))))) >> (((uint64_t)(16)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(17))))) >> (((uint64_t)(17)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(18))))) >> (((uint64_t)(18)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(19))))) >> (((uint64_t)(19)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(20))))) >> (((uint64_t)(20)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(21))))) >> (((uint64_t)(21)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(22))))) >> (((uint64_t)(22)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(23))))) >> (((uint64_t)(23)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(24))))) >> (((uint64_t)(24)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(25))))) >> (((uint64_t)(25)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(26))))) >> (((uint64_t)(26)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(27))))) >> (((uint64_t)(27)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(28))))) >> (((uint64_t)(28)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(29))))) >> (((uint64_t)(29)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(30))))) >> (((uint64_t)(30)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(31))))) >> (((uint64_t)(31)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(32))))) >> (((uint64_t)(32)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(48))))) >> (((uint64_t)(48)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(49))))) >> (((uint64_t)(49)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(50))))) >> (((uint64_t)(50)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(51))))) >> (((uint64_t)(51)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(52))))) >> (((uint64_t)(52)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(53))))) >> (((uint64_t)(53)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(54))))) >> (((uint64_t)(54)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(55))))) >> (((uint64_t)(55)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(56))))) >> (((uint64_t)(56))))) << (((uint64_t)(61)))) | (((((v) & ((((uint64_t)(1))) << (((uint64_t)(0))))) >> (((uint64_t)(0)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(1))))) >> (((uint64_t)(1)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(2))))) >> (((uint64_t)(2)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(4))))) >> (((uint64_t)(4)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(8))))) >> (((uint64_t)(8)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(16))))) >> (((uint64_t)(16)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(32))))) >> (((uint64_t)(32)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(33))))) >> (((uint64_t)(33)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(34))))) >> (((uint64_t)(34)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(35))))) >> (((uint64_t)(35)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(36))))) >> (((uint64_t)(36)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(37))))) >> (((uint64_t)(37)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(38))))) >> (((uint64_t)(38)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(39))))) >> (((uint64_t)(39)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(40))))) >> (((uint64_t)(40)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(41))))) >> (((uint64_t)(41)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(42))))) >> (((uint64_t)(42)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(43))))) >> (((uint64_t)(43)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(44))))) >> (((uint64_t)(44)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(45))))) >> (((uint64_t)(45)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(46))))) >> (((uint64_t)(46)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(47))))) >> (((uint64_t)(47)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(48))))) >> (((uint64_t)(48)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(49))))) >> (((uint64_t)(49)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(50))))) >> (((uint64_t)(50)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(51))))) >> (((uint64_t)(51)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(52))))) >> (((uint64_t)(52)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(53))))) >> (((uint64_t)(53)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(54))))) >> (((uint64_t)(54)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(55))))) >> (((uint64_t)(55)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(56))))) >> (((uint64_t)(56))))) << (((uint64_t)(62)))) | (((((v) & ((((uint64_t)(1))) << (((uint64_t)(0))))) >> (((uint64_t)(0)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(1))))) >> (((uint64_t)(1)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(2))))) >> (((uint64_t)(2)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(3))))) >> (((uint64_t)(3)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(5))))) >> (((uint64_t)(5)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(6))))) >> (((uint64_t)(6)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(8))))) >> (((uint64_t)(8)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(9))))) >> (((uint64_t)(9)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(10))))) >> (((uint64_t)(10)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(12))))) >> (((uint64_t)(12)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(15))))) >> (((uint64_t)(15)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(17))))) >> (((uint64_t)(17)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(18))))) >> (((uint64_t)(18)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(20))))) >> (((uint64_t)(20)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(23))))) >> (((uint64_t)(23)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(24))))) >> (((uint64_t)(24)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(27))))) >> (((uint64_t)(27)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(29))))) >> (((uint64_t)(29)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(30))))) >> (((uint64_t)(30)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(33))))) >> (((uint64_t)(33)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(34))))) >> (((uint64_t)(34)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(36))))) >> (((uint64_t)(36)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(39))))) >> (((uint64_t)(39)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(40))))) >> (((uint64_t)(40)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(43))))) >> (((uint64_t)(43)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(45))))) >> (((uint64_t)(45)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(46))))) >> (((uint64_t)(46)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(48))))) >> (((uint64_t)(48)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(51))))) >> (((uint64_t)(51)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(53))))) >> (((uint64_t)(53)))) ^ (((v) & ((((uint64_t)(1))) << (((uint64_t)(54))))) >> (((uint64_t)(54))))) << (((uint64_t)(63))))))
 
+/*
+ * Updates the codeword c after the lower 57 bits of the encoded data changed
+ * from old_v to new_v. Only the changed bits need to be known, so old_v and
+ * new_v may also be a single field of the data, shifted into place.
+ */
+#define SECDED_64_57_UPDATE(c, old_v, new_v) ((uint64_t)(((uint64_t)(c)) ^ SECDED_64_57_ENCODE((((old_v) ^ (new_v)) & ((((uint64_t)(1)) << (((uint64_t)(57)))) - ((uint64_t)(1)))))))
+
 /*
  * Encodes the lower 57 bits into a 64 bit unsigned integer.
  * The results are guaranteed to have a hamming distance of at least 4.
@@ -428,6 +545,262 @@ template<> constexpr std::int64_t secded_encode_57_bits<std::int64_t>(std::int64
   return SECDED_57_BITS_TO_SIGNED_64(v);
 }
 
+/*
+ * Updates the value c, which was returned by secded_encode_57_bits<T>, after
+ * the lower 57 bits of the encoded data changed from old_v to new_v.
+ */
+template <typename T>
+constexpr typename std::enable_if<std::is_unsigned<T>::value, T>::type secded_update_57_bits(T c, std::uint64_t old_v, std::uint64_t new_v) {
+  return static_cast<T>(c ^ secded_encode_57_bits<T>(static_cast<std::uint64_t>((old_v ^ new_v) & ((std::uint64_t(1) << 57) - 1))));
+}
+
+/*
+ * Updates the value c, which was returned by secded_encode_57_bits<T>, after
+ * the lower 57 bits of the encoded data changed from old_v to new_v.
+ * Wider signed types are not supported because their encoding is not linear.
+ */
+template <typename T>
+constexpr typename std::enable_if<std::is_same<T, std::int64_t>::value, T>::type secded_update_57_bits(T c, std::int64_t old_v, std::int64_t new_v) {
+  return static_cast<T>(c ^ secded_encode_57_bits<T>(static_cast<std::int64_t>((old_v ^ new_v) & ((std::uint64_t(1) << 57) - 1))));
+}
+
+/*
+ * Updates the codewords in words, which were returned by
+ * secded_encode_57_bits<std::uint64_t> and together protect a block of
+ * data, after the n bytes starting at byte offset of the block changed from
+ * old_bytes to new_bytes. Bit j of byte i of the block is stored as bit
+ * (8 * i + j) % 57 of words[(8 * i + j) / 57]. Each word that overlaps
+ * the changed bytes is updated once, all other words are not accessed.
+ */
+inline void secded_update_57_bits_range(std::uint64_t* words, std::size_t offset, const std::uint8_t* old_bytes, const std::uint8_t* new_bytes, std::size_t n) {
+  std::size_t bit = 8 * offset;
+  std::size_t word = bit / 57;
+  std::uint64_t delta = 0;
+  for (std::size_t i = 0; i < n; i++, bit += 8) {
+    const std::uint64_t d = static_cast<std::uint8_t>(old_bytes[i] ^ new_bytes[i]);
+    if (d == 0) continue;
+    const std::size_t shift = bit % 57;
+    if (bit / 57 != word) {
+      if (delta != 0) words[word] = secded_update_57_bits<std::uint64_t>(words[word], 0, delta);
+      word = bit / 57;
+      delta = 0;
+    }
+    delta ^= d << shift;
+    if (shift > 57 - 8) {
+      words[word] = secded_update_57_bits<std::uint64_t>(words[word], 0, delta);
+      word++;
+      delta = d >> (57 - shift);
+    }
+  }
+  if (delta != 0) words[word] = secded_update_57_bits<std::uint64_t>(words[word], 0, delta);
+}
+
 #endif  /* __cplusplus */
 
+#if defined(__cplusplus) && __cplusplus >= 201402L
+
+/*
+ * Returns true if no two of the given states are equal. The states are sorted
+ * with heapsort first, so that this also works for thousands of states within
+ * the compilers' limits for constant expressions.
+ */
+template <typename E, typename... Es>
+constexpr bool secded_states_are_unique(E first, Es... rest) {
+  E states[] = { first, rest... };
+  const std::size_t n = sizeof...(Es) + 1;
+  std::size_t size = n;
+  for (std::size_t i = n / 2 + n - 1; i > 0; i--) {
+    std::size_t root = 0;
+    if (i >= n) {
+      root = i - n;
+    } else {
+      const E tmp = states[0];
+      states[0] = states[i];
+      states[i] = tmp;
+      size = i;
+    }
+    while (2 * root + 1 < size) {
+      std::size_t child = 2 * root + 1;
+      if (child + 1 < size && states[child] < states[child + 1]) child++;
+      if (!(states[root] < states[child])) break;
+      const E tmp = states[root];
+      states[root] = states[child];
+      states[child] = tmp;
+      root = child;
+    }
+  }
+  for (std::size_t i = 1; i < n; i++) {
+    if (states[i - 1] == states[i]) return false;
+  }
+  return true;
+}
+
+/*
+ * Assigns the codeword secded_encode_4_bits<T>(i + 1) (if T is std::uint8_t)
+ * or secded_encode_11_bits<T>(i + 1) (if T is std::uint16_t) to the i-th state
+ * in States. Neither the all-zero nor the all-one value is assigned to any
+ * state.
+ */
+template <typename T, typename E, E... States>
+class secded_state_codes {
+  static_assert(std::is_same<T, std::uint8_t>::value ||
+                std::is_same<T, std::uint16_t>::value,
+                "T must be std::uint8_t or std::uint16_t");
+  static_assert(sizeof...(States) != 0, "States must not be empty");
+  static_assert(sizeof...(States) <=
+                (std::size_t(1) << (std::is_same<T, std::uint8_t>::value ? 4 : 11)) - 2,
+                "Too many states for T");
+  static_assert(secded_states_are_unique(States...),
+                "States must not contain duplicates");
+
+ public:
+  /*
+   * Returns the codeword that was assigned to the given state.
+   */
+  template <E State>
+  static constexpr T codeword() {
+    static_assert(index_of(State) != sizeof...(States), "Unknown state");
+    return encode_index(index_of(State));
+  }
+
+ protected:
+  typedef typename std::conditional<sizeof...(States) < 256, std::uint8_t,
+                                    std::uint16_t>::type index_type;
+
+  template <typename V>
+  struct table_type {
+    V entries[std::size_t(1) << (8 * sizeof(T))];
+  };
+
+  struct index_array {
+    index_type indices[sizeof...(States) + 1];
+  };
+
+  static constexpr T encode_index(std::size_t i) {
+    return std::is_same<T, std::uint8_t>::value ?
+        static_cast<T>(secded_encode_4_bits<std::uint8_t>(static_cast<std::uint8_t>(i + 1))) :
+        static_cast<T>(secded_encode_11_bits<std::uint16_t>(static_cast<std::uint16_t>(i + 1)));
+  }
+
+  static constexpr std::size_t index_of(E state) {
+    const E states[] = { States... };
+    std::size_t i = 0;
+    while (i < sizeof...(States) && states[i] != state) i++;
+    return i;
+  }
+
+  /*
+   * Returns the array { 0, 1, ..., sizeof...(States) }.
+   */
+  static constexpr index_array make_indices() {
+    index_array a {};
+    for (std::size_t i = 0; i <= sizeof...(States); i++) {
+      a.indices[i] = static_cast<index_type>(i);
+    }
+    return a;
+  }
+
+  /*
+   * Maps the codeword of the i-th state and all values that differ from it in
+   * a single bit to values[i + 1], and all other values to values[0].
+   */
+  template <typename V>
+  static constexpr table_type<V> make_table(const V* values) {
+    table_type<V> t {};
+    const V empty = values[0];
+    if (empty != V()) {
+      for (std::size_t v = 0; v < (std::size_t(1) << (8 * sizeof(T))); v++) {
+        t.entries[v] = empty;
+      }
+    }
+    for (std::size_t i = 0; i < sizeof...(States); i++) {
+      const T c = encode_index(i);
+      const V value = values[i + 1];
+      t.entries[c] = value;
+      for (std::size_t b = 0; b < 8 * sizeof(T); b++) {
+        t.entries[static_cast<T>(c ^ (1u << b))] = value;
+      }
+    }
+    return t;
+  }
+};
+
+/*
+ * Maps every possible value of T back to one of the states of
+ * secded_state_codes<T, E, States...> through a single load from a table of E.
+ * Values with a single bit error are mapped to the correct state, all other
+ * values are mapped to Error.
+ */
+template <typename T, typename E, E Error, E... States>
+class secded_state_dispatch : public secded_state_codes<T, E, States...> {
+  typedef secded_state_codes<T, E, States...> codes;
+
+  static_assert(codes::index_of(Error) == sizeof...(States),
+                "Error must not be one of States");
+
+ public:
+  /*
+   * Returns the state that the given value is mapped to.
+   */
+  static constexpr E dispatch(T v) {
+    return table.entries[v];
+  }
+
+ private:
+  typedef typename codes::template table_type<E> table_type;
+
+  static constexpr E states[] = { Error, States... };
+  static constexpr table_type table = codes::make_table(states);
+};
+
+template <typename T, typename E, E Error, E... States>
+constexpr E secded_state_dispatch<T, E, Error, States...>::states[];
+
+template <typename T, typename E, E Error, E... States>
+constexpr typename secded_state_dispatch<T, E, Error, States...>::table_type
+    secded_state_dispatch<T, E, Error, States...>::table;
+
+/*
+ * Same as secded_state_dispatch, but the table stores the smallest unsigned
+ * index type that can hold all states instead of E, followed by a second load
+ * from a small array of states. This reduces the size of the table if E is
+ * larger than the index type, at the cost of an additional dependent load.
+ */
+template <typename T, typename E, E Error, E... States>
+class secded_state_dispatch_compact : public secded_state_codes<T, E, States...> {
+  typedef secded_state_codes<T, E, States...> codes;
+
+  static_assert(codes::index_of(Error) == sizeof...(States),
+                "Error must not be one of States");
+
+ public:
+  /*
+   * Returns the state that the given value is mapped to.
+   */
+  static constexpr E dispatch(T v) {
+    return states[table.entries[v]];
+  }
+
+ private:
+  typedef typename codes::index_array index_array;
+  typedef typename codes::template table_type<typename codes::index_type> table_type;
+
+  static constexpr E states[] = { Error, States... };
+  static constexpr index_array indices = codes::make_indices();
+  static constexpr table_type table = codes::make_table(indices.indices);
+};
+
+template <typename T, typename E, E Error, E... States>
+constexpr E secded_state_dispatch_compact<T, E, Error, States...>::states[];
+
+template <typename T, typename E, E Error, E... States>
+constexpr typename secded_state_dispatch_compact<T, E, Error, States...>::index_array
+    secded_state_dispatch_compact<T, E, Error, States...>::indices;
+
+template <typename T, typename E, E Error, E... States>
+constexpr typename secded_state_dispatch_compact<T, E, Error, States...>::table_type
+    secded_state_dispatch_compact<T, E, Error, States...>::table;
+
+#endif  /* __cplusplus >= 201402L */
+
 #endif  /* CONSTEXPR_SECDED_H */
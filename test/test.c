@@ -96,6 +96,35 @@ static void test_64_bit_low_weight(void) {
   }
 }
 
+static void test_update(void) {
+  uint16_t i, j;
+  for (i = 0; i <= 0xf; i++) {
+    for (j = 0; j <= 0xf; j++) {
+      assert(SECDED_8_4_UPDATE(SECDED_8_4_ENCODE(i), i, j) ==
+             SECDED_8_4_ENCODE(j));
+    }
+  }
+  for (i = 0; i <= 0x7ff; i++) {
+    for (j = 0; j < 11; j++) {
+      assert(SECDED_16_11_UPDATE(SECDED_16_11_ENCODE(i), 0, 1 << j) ==
+             SECDED_16_11_ENCODE(i ^ (1 << j)));
+    }
+  }
+  COMPILE_TIME_CHECK(SECDED_32_26_UPDATE(SECDED_32_26_ENCODE(0x2abcdef), 0xcd00,
+                                         0x1200) ==
+                     SECDED_32_26_ENCODE(0x2ab12ef));
+  COMPILE_TIME_CHECK(SECDED_64_57_UPDATE(SECDED_64_57_ENCODE(0x1234), 0x1234,
+                                         0x4321) ==
+                     SECDED_64_57_ENCODE(0x4321));
+
+  /* Bits above the data bits of old_v and new_v are ignored. */
+  COMPILE_TIME_CHECK(SECDED_8_4_UPDATE(SECDED_8_4_ENCODE(0x5), 0xf0, 0x00) ==
+                     SECDED_8_4_ENCODE(0x5));
+  COMPILE_TIME_CHECK(SECDED_64_57_UPDATE(SECDED_64_57_ENCODE(0x1234),
+                                         (uint64_t) 0x7f << 57, 0) ==
+                     SECDED_64_57_ENCODE(0x1234));
+}
+
 int main(void) {
   test_generated_test_vectors();
   test_additive_identity();
@@ -103,5 +132,6 @@ int main(void) {
   test_16_bit_minimum_distance();
   test_32_bit_low_weight();
   test_64_bit_low_weight();
+  test_update();
   return 0;
 }
@@ -4,6 +4,7 @@
 # error "Do not specify NDEBUG for tests."
 #endif
 #include <cassert>
+#include <utility>
 
 #define COMPILE_TIME_CHECK(x) static_assert(x, "Assertion failed")
 
@@ -49,6 +50,90 @@ static void test_functions_are_constexpr() {
           SECDED_4_BITS_TO_UNSIGNED_32(1));
 }
 
+static void test_update_matches_encode() {
+  COMPILE_TIME_CHECK(
+      secded_update_4_bits<std::uint8_t>(
+          secded_encode_4_bits<std::uint8_t>(0x3), 0x3, 0xc) ==
+          secded_encode_4_bits<std::uint8_t>(0xc));
+  COMPILE_TIME_CHECK(
+      secded_update_11_bits<std::uint32_t>(
+          secded_encode_11_bits<std::uint32_t>(0x5a5), 0x0a0, 0x050) ==
+          secded_encode_11_bits<std::uint32_t>(0x555));
+  COMPILE_TIME_CHECK(
+      secded_update_26_bits<std::int32_t>(
+          secded_encode_26_bits<std::int32_t>(0x1000), 0x1000, 0x2000001) ==
+          secded_encode_26_bits<std::int32_t>(0x2000001));
+  COMPILE_TIME_CHECK(
+      secded_update_57_bits<std::uint64_t>(
+          secded_encode_57_bits<std::uint64_t>(0), 0, 0x100000000000000) ==
+          secded_encode_57_bits<std::uint64_t>(0x100000000000000));
+
+  for (std::uint8_t i = 0; i <= 0xf; i++) {
+    for (std::uint8_t j = 0; j <= 0xf; j++) {
+      assert(secded_update_4_bits<std::uint64_t>(
+                 secded_encode_4_bits<std::uint64_t>(i), i, j) ==
+             secded_encode_4_bits<std::uint64_t>(j));
+      assert(secded_update_4_bits<std::int8_t>(
+                 secded_encode_4_bits<std::int8_t>(i), i, j) ==
+             secded_encode_4_bits<std::int8_t>(j));
+    }
+  }
+}
+
+template <typename T, std::size_t K, std::size_t N>
+static void encode_block(T (&words)[N], const std::uint8_t* bytes) {
+  for (std::size_t w = 0; w < N; w++) {
+    T v = 0;
+    for (std::size_t b = 0; b < K; b++) {
+      const std::size_t bit = w * K + b;
+      assert(bit / 8 < (N * K + 7) / 8);
+      v |= static_cast<T>((bytes[bit / 8] >> (bit % 8)) & 1) << b;
+    }
+    words[w] = v;
+  }
+}
+
+template <typename T, std::size_t K, typename Encode, typename UpdateRange>
+static void test_update_range(Encode encode, UpdateRange update_range) {
+  const std::size_t n_bytes = (4 * K + 7) / 8;
+  std::uint8_t old_bytes[n_bytes], new_bytes[n_bytes];
+  for (std::size_t i = 0; i < n_bytes; i++) {
+    old_bytes[i] = static_cast<std::uint8_t>(i * 37 + 11);
+  }
+
+  const std::size_t ranges[][2] = {
+    { 0, n_bytes }, { 0, 1 }, { K / 8, 1 }, { K / 8, 2 }, { 3, K / 4 },
+    { n_bytes - 1, 1 }
+  };
+  for (const auto& range : ranges) {
+    for (std::size_t i = 0; i < n_bytes; i++) {
+      const bool dirty = i >= range[0] && i < range[0] + range[1];
+      // Bits past the end of the last word are not part of the block.
+      const std::size_t valid_bits = 4 * K - 8 * i;
+      const unsigned int mask = valid_bits >= 8 ? 0xff : (1u << valid_bits) - 1;
+      new_bytes[i] = static_cast<std::uint8_t>(
+          dirty && i % 4 != 2 ? old_bytes[i] ^ ((i * 91 + 1) & mask)
+                              : old_bytes[i]);
+    }
+
+    T data[4], words[4], expected[4];
+    encode_block<T, K>(data, old_bytes);
+    for (std::size_t w = 0; w < 4; w++) words[w] = encode(data[w]);
+    update_range(words, range[0], old_bytes + range[0], new_bytes + range[0],
+                 range[1]);
+    encode_block<T, K>(data, new_bytes);
+    for (std::size_t w = 0; w < 4; w++) expected[w] = encode(data[w]);
+    for (std::size_t w = 0; w < 4; w++) assert(words[w] == expected[w]);
+  }
+}
+
+static void test_update_ranges() {
+  test_update_range<std::uint32_t, 26>(secded_encode_26_bits<std::uint32_t>,
+                                       secded_update_26_bits_range);
+  test_update_range<std::uint64_t, 57>(secded_encode_57_bits<std::uint64_t>,
+                                       secded_update_57_bits_range);
+}
+
 #if __cplusplus >= 201402L
 # define CXX14_CONSTEXPR constexpr
 # define CXX14_COMPILE_TIME_CHECK COMPILE_TIME_CHECK
@@ -67,9 +152,150 @@ static void test_functions_are_real_functions() {
   CXX14_COMPILE_TIME_CHECK(encode_does_double_eval() == 0);
 }
 
+#if __cplusplus >= 201402L
+enum class test_state : std::uint8_t {
+  idle, connecting, connected, closing, error
+};
+
+template <typename T>
+using test_dispatch = secded_state_dispatch<T, test_state,
+    test_state::error, test_state::idle, test_state::connecting,
+    test_state::connected, test_state::closing>;
+
+template <typename T>
+using test_dispatch_compact = secded_state_dispatch_compact<T, test_state,
+    test_state::error, test_state::idle, test_state::connecting,
+    test_state::connected, test_state::closing>;
+
+template <typename T, typename Seq>
+struct test_dispatch_sequence;
+
+template <typename T, std::uint16_t... Is>
+struct test_dispatch_sequence<T, std::integer_sequence<std::uint16_t, Is...>> {
+  typedef secded_state_dispatch<T, std::uint16_t, 0xffff, Is...> type;
+  typedef secded_state_dispatch_compact<T, std::uint16_t, 0xffff, Is...> compact;
+};
+
+// Dispatches the states 0, 1, ..., N - 1 with the error state 0xffff.
+template <typename T, std::size_t N>
+using test_dispatch_n =
+    test_dispatch_sequence<T, std::make_integer_sequence<std::uint16_t, N>>;
+
+// Each of these must fail to compile, see the Makefile.
+#if TEST_COMPILE_ERROR == 1
+COMPILE_TIME_CHECK(sizeof(test_dispatch_n<std::uint8_t, 15>::type) != 0);
+#elif TEST_COMPILE_ERROR == 2
+COMPILE_TIME_CHECK(sizeof(test_dispatch_n<std::uint16_t, 2047>::type) != 0);
+#elif TEST_COMPILE_ERROR == 3
+COMPILE_TIME_CHECK(sizeof(secded_state_dispatch<std::uint8_t, test_state,
+    test_state::error, test_state::idle, test_state::connecting,
+    test_state::idle>) != 0);
+#elif TEST_COMPILE_ERROR == 4
+COMPILE_TIME_CHECK(sizeof(secded_state_dispatch<std::uint8_t, test_state,
+    test_state::idle, test_state::idle, test_state::connecting>) != 0);
+#elif TEST_COMPILE_ERROR == 5
+COMPILE_TIME_CHECK(test_dispatch<std::uint8_t>::codeword<test_state::error>() != 0);
+#endif
+
+static unsigned int distance(std::uint16_t a, std::uint16_t b) {
+  unsigned int n = 0;
+  for (std::uint16_t v = a ^ b; v != 0; v &= v - 1) n++;
+  return n;
+}
+
+template <typename T, typename D>
+static void test_state_dispatch_exhaustive() {
+  const test_state states[] = { test_state::idle, test_state::connecting,
+                                test_state::connected, test_state::closing };
+  const T codewords[] = { D::template codeword<test_state::idle>(),
+                          D::template codeword<test_state::connecting>(),
+                          D::template codeword<test_state::connected>(),
+                          D::template codeword<test_state::closing>() };
+  for (std::uint32_t v = 0; v <= T(~T(0)); v++) {
+    test_state expected = test_state::error;
+    for (std::size_t i = 0; i < 4; i++) {
+      if (distance(static_cast<T>(v), codewords[i]) <= 1) {
+        expected = states[i];
+      }
+    }
+    assert(D::dispatch(static_cast<T>(v)) == expected);
+  }
+}
+
+template <typename T, std::size_t N, typename D>
+static void test_state_dispatch_limit(T (*encode)(T)) {
+  std::size_t n_states = 0;
+  for (std::uint32_t v = 0; v <= T(~T(0)); v++) {
+    n_states += D::dispatch(static_cast<T>(v)) != 0xffff;
+  }
+  assert(n_states == N * (8 * sizeof(T) + 1));
+  for (std::size_t i = 0; i < N; i++) {
+    const T c = encode(static_cast<T>(i + 1));
+    assert(D::dispatch(c) == i);
+    for (std::size_t b = 0; b < 8 * sizeof(T); b++) {
+      assert(D::dispatch(static_cast<T>(c ^ (1u << b))) == i);
+    }
+  }
+}
+
+static void test_state_dispatch() {
+  typedef test_dispatch<std::uint8_t> d8;
+  COMPILE_TIME_CHECK(d8::codeword<test_state::idle>() ==
+                     secded_encode_4_bits<std::uint8_t>(1));
+  COMPILE_TIME_CHECK(d8::codeword<test_state::closing>() ==
+                     secded_encode_4_bits<std::uint8_t>(4));
+  COMPILE_TIME_CHECK(d8::dispatch(d8::codeword<test_state::connected>()) ==
+                     test_state::connected);
+  COMPILE_TIME_CHECK(d8::dispatch(d8::codeword<test_state::connected>() ^ 0x40) ==
+                     test_state::connected);
+  COMPILE_TIME_CHECK(d8::dispatch(d8::codeword<test_state::connected>() ^ 0x41) ==
+                     test_state::error);
+  COMPILE_TIME_CHECK(d8::dispatch(secded_encode_4_bits<std::uint8_t>(5)) ==
+                     test_state::error);
+  COMPILE_TIME_CHECK(d8::dispatch(0x00) == test_state::error);
+  COMPILE_TIME_CHECK(d8::dispatch(0xff) == test_state::error);
+
+  typedef test_dispatch<std::uint16_t> d16;
+  COMPILE_TIME_CHECK(d16::codeword<test_state::connecting>() ==
+                     secded_encode_11_bits<std::uint16_t>(2));
+  COMPILE_TIME_CHECK(d16::dispatch(0x0000) == test_state::error);
+  COMPILE_TIME_CHECK(d16::dispatch(0xffff) == test_state::error);
+  COMPILE_TIME_CHECK(d16::dispatch(d16::codeword<test_state::closing>() ^ 0x8000) ==
+                     test_state::closing);
+
+  typedef test_dispatch_compact<std::uint16_t> c16;
+  COMPILE_TIME_CHECK(c16::codeword<test_state::connecting>() ==
+                     d16::codeword<test_state::connecting>());
+  COMPILE_TIME_CHECK(c16::dispatch(0x0000) == test_state::error);
+  COMPILE_TIME_CHECK(c16::dispatch(c16::codeword<test_state::closing>() ^ 0x0001) ==
+                     test_state::closing);
+
+  test_state_dispatch_exhaustive<std::uint8_t, d8>();
+  test_state_dispatch_exhaustive<std::uint16_t, d16>();
+  test_state_dispatch_exhaustive<std::uint8_t,
+                                 test_dispatch_compact<std::uint8_t>>();
+  test_state_dispatch_exhaustive<std::uint16_t, c16>();
+
+  test_state_dispatch_limit<std::uint8_t, 14,
+                            test_dispatch_n<std::uint8_t, 14>::type>(
+      secded_encode_4_bits<std::uint8_t>);
+  test_state_dispatch_limit<std::uint16_t, 2046,
+                            test_dispatch_n<std::uint16_t, 2046>::type>(
+      secded_encode_11_bits<std::uint16_t>);
+  test_state_dispatch_limit<std::uint16_t, 2046,
+                            test_dispatch_n<std::uint16_t, 2046>::compact>(
+      secded_encode_11_bits<std::uint16_t>);
+}
+#endif
+
 int main(void) {
   test_generated_test_vectors();
   test_functions_are_constexpr();
   test_functions_are_real_functions();
+  test_update_matches_encode();
+  test_update_ranges();
+#if __cplusplus >= 201402L
+  test_state_dispatch();
+#endif
   return 0;
 }